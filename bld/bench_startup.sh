@@ -0,0 +1,66 @@
+#!/bin/bash
+# bld/bench_startup.sh
+# Guard `luametry run` startup time for a trivial cube
+#
+# Compares the run against `luametry --help`, which starts the same binary
+# but loads no CAD modules, so the check holds on slow or loaded hosts.
+# Both are timed as best of STARTUP_RUNS after a warm-up run (page cache
+# warm), which isolates module loading and init from disk latency.
+# Fails when the cube run costs more than STARTUP_RATIO x the help run
+# (plus STARTUP_SLACK_MS for timer noise), or exceeds STARTUP_BUDGET_MS
+# when that absolute limit is set.
+
+set -e
+
+# Ensure we are in the project root
+cd "$(dirname "$0")/.."
+
+BIN="./bin/luametry"
+RUNS="${STARTUP_RUNS:-5}"
+RATIO="${STARTUP_RATIO:-4}"
+SLACK_MS="${STARTUP_SLACK_MS:-20}"
+BUDGET_MS="${STARTUP_BUDGET_MS:-}"
+
+if [ ! -x "$BIN" ]; then
+    echo "Error: $BIN not found. Run bld/build.sh first." >&2
+    exit 1
+fi
+
+TMP_DIR="$(mktemp -d)"
+trap 'rm -rf "$TMP_DIR"' EXIT
+
+cat > "$TMP_DIR/cube.lua" <<'LUA'
+cad = require("cad")
+return cad.cube(10)
+LUA
+
+# Best-of-N wall time in microseconds for the given command
+best_us() {
+    "$@" > /dev/null || return 1
+    best=""
+    for i in $(seq 1 "$RUNS"); do
+        start=$(date +%s%N)
+        "$@" > /dev/null || return 1
+        end=$(date +%s%N)
+        us=$(( (end - start) / 1000 ))
+        if [ -z "$best" ] || [ "$us" -lt "$best" ]; then
+            best=$us
+        fi
+    done
+    echo "$best"
+}
+
+help_us=$(best_us "$BIN" --help)
+run_us=$(best_us "$BIN" run "$TMP_DIR/cube.lua" -o "$TMP_DIR/cube.stl")
+limit_us=$(( help_us * RATIO + SLACK_MS * 1000 ))
+
+echo "Startup: luametry --help ${help_us}us, run cube.lua ${run_us}us (limit ${limit_us}us = ${RATIO}x help + ${SLACK_MS}ms)"
+if [ "$run_us" -gt "$limit_us" ]; then
+    echo "Startup benchmark FAILED: cube run exceeds ${RATIO}x bare startup" >&2
+    exit 1
+fi
+
+if [ -n "$BUDGET_MS" ] && [ "$run_us" -gt $(( BUDGET_MS * 1000 )) ]; then
+    echo "Startup benchmark FAILED: cube run exceeds ${BUDGET_MS}ms budget" >&2
+    exit 1
+fi
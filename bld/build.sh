@@ -27,6 +27,17 @@ if [ -z "$LFS_DIR" ]; then
     LFS_DIR="$LUAM_DIR/lib/lfs"
 fi
 
+# Bytecode compiler from the same luam checkout as liblua.a, so the bytecode
+# format matches the embedded interpreter (allow env override)
+if [ -z "$LUAC" ]; then
+    for candidate in "$LUAM_DIR/bin/luamc" "$LUAM_DIR/src/luac"; do
+        if [ -x "$candidate" ]; then
+            LUAC="$candidate"
+            break
+        fi
+    done
+fi
+
 if [ -z "$LUAM_DIR" ] || [ ! -f "$LUAM_DIR/src/lauxlib.h" ]; then
     echo "Error: LUAM_DIR not set or lauxlib.h not found. Set LUAM_DIR to your luam checkout." >&2
     exit 1
@@ -77,18 +88,47 @@ cp src/cli.lua .
 mkdir -p lib
 cp src/lib/*.lua lib/
 
+# Embed stripped bytecode instead of sources so startup skips the parser.
+# Files keep their .lua names so luastatic derives the same module names.
+EMBED_MODULES="cad.lua shapes.lua stl.lua step.lua obj.lua threemf.lua font.lua cli.lua lib/argparse.lua lib/utils.lua lib/dataframes.lua lib/string_utils.lua lib/table_utils.lua"
+if [ -n "$LUAC" ]; then
+    echo "Precompiling Lua modules with $LUAC"
+    for mod in $EMBED_MODULES; do
+        "$LUAC" -s -o "$mod.out" "$mod"
+        mv "$mod.out" "$mod"
+    done
+else
+    echo "Warning: no bytecode compiler found (set LUAC), embedding Lua sources" >&2
+fi
+
 cp obj/csg_manifold.a ./csg_manifold.a
 cp obj/lfs.a ./lfs.a
 
 echo "Generating static binary with luastatic"
 export CC=g++
-luam $LUAM_DIR/lib/static/static.lua entry.lua cad.lua shapes.lua stl.lua step.lua obj.lua threemf.lua font.lua cli.lua \
-    lib/argparse.lua lib/utils.lua lib/dataframes.lua lib/string_utils.lua lib/table_utils.lua \
+luam $LUAM_DIR/lib/static/static.lua entry.lua $EMBED_MODULES \
     csg_manifold.a lfs.a $LIB_LUA $INC_LUA $LIB_MANIFOLD_FLAGS $LIBS
 
 echo "Finalizing"
 mkdir -p bin && mv entry bin/$PROJECT
 
+if [ -n "$LUAC" ]; then
+    # A mismatched compiler still links fine but fails at load time
+    echo "Verifying embedded bytecode loads"
+    CHECK_SCRIPT="$(mktemp --suffix=.lua)"
+    for mod in $EMBED_MODULES; do
+        name="${mod%.lua}"
+        echo "require(\"${name//\//.}\")" >> "$CHECK_SCRIPT"
+    done
+    echo "return true" >> "$CHECK_SCRIPT"
+    if ! ./bin/$PROJECT run "$CHECK_SCRIPT" > /dev/null; then
+        rm -f "$CHECK_SCRIPT"
+        echo "Error: embedded bytecode failed to load. $LUAC does not match $LIB_LUA; set LUAC to the compiler from your luam checkout." >&2
+        exit 1
+    fi
+    rm -f "$CHECK_SCRIPT"
+fi
+
 echo "Cleanup"
 rm -f cad.lua shapes.lua stl.lua step.lua obj.lua threemf.lua font.lua cli.lua csg_manifold.a lfs.a entry.static.c
 rm -rf lib/
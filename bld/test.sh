@@ -2,7 +2,13 @@
 # bld/test.sh
 # Run the Luametry test suite
 
+set -e
+
 # Ensure we are in the project root
 cd "$(dirname "$0")/.."
 
 ./bin/luametry run tst/run_all.lua
+
+# Timing is reported separately from the suite result above
+echo ""
+bash bld/bench_startup.sh
@@ -1,8 +1,5 @@
+-- step, obj, threemf and font are required on first use to keep startup cheap
 stl = require("stl")
-step = require("step")
-obj = require("obj")
-threemf = require("threemf")
-font = require("font")
 script_path = string.match(debug.getinfo(1).source, "@(.*[\\/])") or "./"
 package.cpath = package.cpath .. ";" .. script_path .. "?.so"
 csg = require("csg.manifold")
@@ -103,6 +100,7 @@ function cad.create.from_obj(filename)
     content = io.read("*a")
     io.close(f)
     
+    obj = require("obj")
     mesh = obj.decode(content)
     return cad.create.from_mesh(mesh.verts, mesh.faces)
 end
@@ -131,6 +129,7 @@ function cad.create.revolve(points, params)
 end
 
 function cad.create.text(text_str, params)
+    font = require("font")
     return font.create_text(text_str, params)
 end
 
@@ -177,6 +176,13 @@ end
 
 cad.modify.bevel = cad.modify.chamfer
 
+function cad.modify.simplify(node, tolerance)
+    -- Collapse near-coplanar slivers (e.g. after fillets or warps)
+    -- without moving the surface by more than tolerance
+    if type(tolerance) != "number" then error("cad.simplify requires a numeric tolerance") end
+    return { type = "simplify", child = node, tolerance = tolerance }
+end
+
 -- ============================================================================
 -- 3. Combine (Booleans & Topology)
 -- ============================================================================
@@ -331,6 +337,11 @@ function render_node(node)
     elseif node.type == "warp" then
         return csg.warp(render_node(node.child), node.warp_func)
     
+    elseif node.type == "simplify" then
+        res, stats = csg.simplify(render_node(node.child), node.tolerance, true)
+        node.stats = stats -- tris_before, tris_after, max_deviation
+        return res
+
     elseif node.type == "trim" then
         return csg.trim_by_plane(render_node(node.child), node.nx, node.ny, node.nz, node.offset)
         
@@ -407,18 +418,28 @@ function geometry_to_stl_solid(mesh)
     return solid
 end
 
-function cad.export(node, filename)
+-- opts.simplify = tolerance simplifies before writing; the stats table
+-- (tris_before, tris_after, max_deviation) is returned after the status
+function cad.export(node, filename, opts)
+    opts = opts or {}
     man = render_node(node)
+    stats = nil
+    if opts.simplify != nil then
+        man, stats = csg.simplify(man, opts.simplify, true)
+    end
     mesh = csg.to_mesh(man)
     if mesh == nil then return false end
     
     content = nil
     if (string.match(filename, "%.step$") != nil) or (string.match(filename, "%.stp$") != nil) then
+        step = require("step")
         content = step.encode_mesh(mesh)
     elseif string.match(filename, "%.obj$") != nil then
+        obj = require("obj")
         content = obj.encode_mesh(mesh)
     elseif string.match(filename, "%.3mf$") != nil then
-        return threemf.export(mesh, filename)
+        threemf = require("threemf")
+        return threemf.export(mesh, filename), stats
     else
         solid = geometry_to_stl_solid(mesh)
         content = stl.encode_solid(solid)
@@ -428,7 +449,7 @@ function cad.export(node, filename)
     if f != nil then
         io.write(f, content)
         io.close(f)
-        return true
+        return true, stats
     end
     return false
 end
@@ -457,6 +478,7 @@ cad.fillet = cad.modify.fillet
 cad.round = cad.modify.fillet
 cad.chamfer = cad.modify.chamfer
 cad.bevel = cad.modify.chamfer
+cad.simplify = cad.modify.simplify
 
 cad.union = cad.combine.union
 cad.difference = cad.combine.difference
@@ -12,24 +12,52 @@ cli.config = {
 }
 
 -- Helper to get the real home directory (handles sudo)
+-- Reads /etc/passwd directly; users that only exist through NSS (LDAP,
+-- sssd, systemd-homed) fall back to getent. The result is cached since
+-- watch mode asks for it every second.
 function cli.get_real_home()
-    h = os.getenv("HOME")
+    if cli.real_home != nil then return cli.real_home end
     su = os.getenv("SUDO_USER")
     if su != nil and su != "" then
-        tmp = "/tmp/luam_home"
-        os.execute("getent passwd " .. su .. " | cut -d: -f6 > " .. tmp)
-        f = io.open(tmp, "r")
-        if f != nil then
-            io.input(f)
-            rh = io.read("*l")
-            io.close(f)
-            os.remove(tmp)
-            if rh != nil and rh != "" then
-                return rh
-            end
+        rh = cli.passwd_home(su) or cli.getent_home(su)
+        if rh != nil then
+            cli.real_home = rh
+            return rh
+        end
+    end
+    cli.real_home = os.getenv("HOME")
+    return cli.real_home
+end
+
+function cli.passwd_home(user)
+    f = io.open("/etc/passwd", "r")
+    if f == nil then return nil end
+    io.input(f)
+    content = io.read("*a")
+    io.close(f)
+    for line in string.gmatch(content, "[^\n]+") do
+        name, rh = string.match(line, "^([^:]*):[^:]*:[^:]*:[^:]*:[^:]*:([^:]*)")
+        if name == user and rh != nil and rh != "" then
+            return rh
         end
     end
-    return h
+    return nil
+end
+
+function cli.getent_home(user)
+    -- Only plain account names reach the shell
+    if string.match(user, "^[%w._-]+$") == nil then return nil end
+    p = io.popen("getent passwd '" .. user .. "'", "r")
+    if p == nil then return nil end
+    io.input(p)
+    line = io.read("*l")
+    io.close(p)
+    if line == nil then return nil end
+    rh = string.match(line, "^[^:]*:[^:]*:[^:]*:[^:]*:[^:]*:([^:]*)")
+    if rh != nil and rh != "" then
+        return rh
+    end
+    return nil
 end
 
 -- Load config file
@@ -74,8 +102,13 @@ Runs a CAD script and generates an STL file.
 Required:
 <file>  Path to the Lua CAD script.
 
+Optional:
+-o --output <file>  Output path (default: out/<script>.stl)
+--simplify <tol>    Simplify the mesh within <tol> before export
+
 Examples:
 luametry run tst/benchy.lua
+luametry run tst/benchy.lua --simplify 0.01
     """,
     ["luametry live"] = """
 Description:
@@ -100,9 +133,13 @@ Required:
 <file>         Path to the Lua CAD script.
 -o, --output   Path to the output file (STL or STEP).
 
+Optional:
+--simplify <tol>  Simplify the mesh within <tol> before export
+
 Examples:
 luametry export tst/benchy.lua -o out/result.stl
 luametry export tst/bolt.lua -o out/bolt.step
+luametry export tst/benchy.lua -o out/result.3mf --simplify 0.01
     """,
     ["luametry install"] = """
 Description:
@@ -262,6 +299,24 @@ function cli.safe_dofile(path)
     return res
 end
 
+-- Parse the value following --simplify
+function cli.parse_tolerance(value)
+    tol = nil
+    if value != nil then tol = tonumber(value) end
+    if tol == nil or tol < 0 then
+        print("Error: --simplify expects a non-negative numeric tolerance")
+        return nil
+    end
+    return tol
+end
+
+-- Print the reduction reported by cad.export
+function cli.report_simplify(stats, tolerance)
+    if stats == nil then return end
+    print(string.format("Simplified: %d -> %d triangles (max deviation %.6g, tolerance %.6g)",
+        stats.tris_before, stats.tris_after, stats.max_deviation, tolerance))
+end
+
 -- Run a script
 function cli.do_run(cmd_args)
     -- Check for help flags first
@@ -274,6 +329,7 @@ function cli.do_run(cmd_args)
     
     script = nil
     output_path = nil
+    simplify = nil
     
     i = 1
     while i <= #cmd_args do
@@ -281,6 +337,10 @@ function cli.do_run(cmd_args)
         if a == "-o" or a == "--output" then
             output_path = cmd_args[i + 1]
             i = i + 2
+        elseif a == "--simplify" then
+            simplify = cli.parse_tolerance(cmd_args[i + 1])
+            if simplify == nil then return "error" end
+            i = i + 2
         else
             if script == nil then
                 script = a
@@ -306,9 +366,11 @@ function cli.do_run(cmd_args)
         end
         cad_mod = require("cad")
         print("Exporting to " .. output_path .. "...")
-        if cad_mod.export(res, output_path) == false then
+        ok, stats = cad_mod.export(res, output_path, {simplify = simplify})
+        if ok == false then
             return "error"
         end
+        cli.report_simplify(stats, simplify)
         print("Success.")
     end
     
@@ -433,6 +495,7 @@ function cli.do_export(cmd_args)
     
     script = nil
     output_path = nil
+    simplify = nil
     
     i = 1
     while i <= #cmd_args do
@@ -440,6 +503,10 @@ function cli.do_export(cmd_args)
         if a == "-o" or a == "--output" then
             output_path = cmd_args[i + 1]
             i = i + 2
+        elseif a == "--simplify" then
+            simplify = cli.parse_tolerance(cmd_args[i + 1])
+            if simplify == nil then return "error" end
+            i = i + 2
         else
             if script == nil then
                 script = a
@@ -472,7 +539,8 @@ function cli.do_export(cmd_args)
     
     cad_mod = require("cad")
     print("Exporting to " .. output_path .. "...")
-    success = cad_mod.export(result, output_path)
+    success, stats = cad_mod.export(result, output_path, {simplify = simplify})
+    cli.report_simplify(stats, simplify)
     
     if success then
         print("Success.")
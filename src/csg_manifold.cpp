@@ -4,6 +4,8 @@ extern "C" {
 #include <lualib.h>
 }
 #include <manifold/manifoldc.h>
+#include <algorithm>
+#include <math.h>
 #include <stdlib.h>
 #include <vector>
 
@@ -612,6 +614,258 @@ static int l_decompose(lua_State *L) {
   return 1;
 }
 
+// Simplify helpers: flat copies of MeshGL positions and triangle indices
+static void read_mesh(ManifoldManifold *m, std::vector<float> &pos,
+                      std::vector<uint32_t> &tris) {
+  ManifoldMeshGL *mesh = manifold_get_meshgl(malloc(manifold_meshgl_size()), m);
+  size_t n_verts = manifold_meshgl_num_vert(mesh);
+  size_t n_props = manifold_meshgl_num_prop(mesh);
+
+  std::vector<float> props(manifold_meshgl_vert_properties_length(mesh));
+  manifold_meshgl_vert_properties(props.data(), mesh);
+  pos.resize(n_verts * 3);
+  for (size_t i = 0; i < n_verts; ++i) {
+    pos[i * 3 + 0] = props[i * n_props + 0];
+    pos[i * 3 + 1] = props[i * n_props + 1];
+    pos[i * 3 + 2] = props[i * n_props + 2];
+  }
+
+  tris.resize(manifold_meshgl_tri_length(mesh));
+  manifold_meshgl_tri_verts(tris.data(), mesh);
+
+  manifold_destruct_meshgl(mesh);
+  free(mesh);
+}
+
+// Squared distance from point p to triangle (a, b, c)
+// (closest-point by Voronoi region, Ericson "Real-Time Collision Detection")
+static double point_tri_dist2(const double *p, const double *a, const double *b,
+                              const double *c) {
+  double ab[3], ac[3], ap[3], q[3];
+  for (int k = 0; k < 3; ++k) {
+    ab[k] = b[k] - a[k];
+    ac[k] = c[k] - a[k];
+    ap[k] = p[k] - a[k];
+  }
+  double d1 = ab[0] * ap[0] + ab[1] * ap[1] + ab[2] * ap[2];
+  double d2 = ac[0] * ap[0] + ac[1] * ap[1] + ac[2] * ap[2];
+
+  double bp[3], cp[3];
+  for (int k = 0; k < 3; ++k) {
+    bp[k] = p[k] - b[k];
+    cp[k] = p[k] - c[k];
+  }
+  double d3 = ab[0] * bp[0] + ab[1] * bp[1] + ab[2] * bp[2];
+  double d4 = ac[0] * bp[0] + ac[1] * bp[1] + ac[2] * bp[2];
+  double d5 = ab[0] * cp[0] + ab[1] * cp[1] + ab[2] * cp[2];
+  double d6 = ac[0] * cp[0] + ac[1] * cp[1] + ac[2] * cp[2];
+
+  double va = d3 * d6 - d5 * d4;
+  double vb = d5 * d2 - d1 * d6;
+  double vc = d1 * d4 - d3 * d2;
+
+  if (d1 <= 0 && d2 <= 0) {
+    for (int k = 0; k < 3; ++k) q[k] = a[k];
+  } else if (d3 >= 0 && d4 <= d3) {
+    for (int k = 0; k < 3; ++k) q[k] = b[k];
+  } else if (d6 >= 0 && d5 <= d6) {
+    for (int k = 0; k < 3; ++k) q[k] = c[k];
+  } else if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+    double v = d1 / (d1 - d3);
+    for (int k = 0; k < 3; ++k) q[k] = a[k] + v * ab[k];
+  } else if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+    double w = d2 / (d2 - d6);
+    for (int k = 0; k < 3; ++k) q[k] = a[k] + w * ac[k];
+  } else if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+    double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    for (int k = 0; k < 3; ++k) q[k] = b[k] + w * (c[k] - b[k]);
+  } else {
+    double denom = 1.0 / (va + vb + vc);
+    double v = vb * denom;
+    double w = vc * denom;
+    for (int k = 0; k < 3; ++k) q[k] = a[k] + ab[k] * v + ac[k] * w;
+  }
+
+  double dx = p[0] - q[0], dy = p[1] - q[1], dz = p[2] - q[2];
+  return dx * dx + dy * dy + dz * dz;
+}
+
+// Bounding volume hierarchy over the simplified triangles, used to find the
+// closest face to each original vertex
+struct BvhNode {
+  double lo[3], hi[3];
+  uint32_t start, count; // triangle range (leaves only)
+  int left, right;       // child indices, -1 for leaves
+};
+
+struct Bvh {
+  const std::vector<float> *pos;
+  const std::vector<uint32_t> *tris;
+  std::vector<uint32_t> order; // triangle ids, grouped by leaf
+  std::vector<double> centroid;
+  std::vector<BvhNode> nodes;
+
+  void corner(uint32_t t, int v, double *out) const {
+    for (int k = 0; k < 3; ++k)
+      out[k] = (*pos)[(*tris)[t * 3 + v] * 3 + k];
+  }
+
+  int build(uint32_t start, uint32_t count) {
+    BvhNode node;
+    for (int k = 0; k < 3; ++k) {
+      node.lo[k] = HUGE_VAL;
+      node.hi[k] = -HUGE_VAL;
+    }
+    for (uint32_t i = start; i < start + count; ++i) {
+      for (int v = 0; v < 3; ++v) {
+        double p[3];
+        corner(order[i], v, p);
+        for (int k = 0; k < 3; ++k) {
+          node.lo[k] = fmin(node.lo[k], p[k]);
+          node.hi[k] = fmax(node.hi[k], p[k]);
+        }
+      }
+    }
+    node.start = start;
+    node.count = count;
+    node.left = node.right = -1;
+
+    int idx = (int)nodes.size();
+    nodes.push_back(node);
+    if (count <= 4)
+      return idx;
+
+    // Median split on the longest axis keeps the depth at O(log n)
+    int axis = 0;
+    for (int k = 1; k < 3; ++k)
+      if (node.hi[k] - node.lo[k] > node.hi[axis] - node.lo[axis])
+        axis = k;
+    uint32_t half = count / 2;
+    std::nth_element(order.begin() + start, order.begin() + start + half,
+                     order.begin() + start + count,
+                     [&](uint32_t x, uint32_t y) {
+                       return centroid[x * 3 + axis] < centroid[y * 3 + axis];
+                     });
+
+    int left = build(start, half);
+    int right = build(start + half, count - half);
+    nodes[idx].left = left;
+    nodes[idx].right = right;
+    nodes[idx].count = 0;
+    return idx;
+  }
+
+  static double box_dist2(const BvhNode &n, const double *p) {
+    double d2 = 0;
+    for (int k = 0; k < 3; ++k) {
+      double d = fmax(fmax(n.lo[k] - p[k], p[k] - n.hi[k]), 0.0);
+      d2 += d * d;
+    }
+    return d2;
+  }
+
+  double closest_dist2(const double *p) const {
+    double best = HUGE_VAL;
+    std::vector<int> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+      const BvhNode &n = nodes[stack.back()];
+      stack.pop_back();
+      if (box_dist2(n, p) >= best)
+        continue;
+      if (n.left < 0) {
+        for (uint32_t i = n.start; i < n.start + n.count; ++i) {
+          double a[3], b[3], c[3];
+          corner(order[i], 0, a);
+          corner(order[i], 1, b);
+          corner(order[i], 2, c);
+          best = fmin(best, point_tri_dist2(p, a, b, c));
+        }
+        continue;
+      }
+      // Visit the nearer child first so the far one is usually pruned
+      int first = n.left, second = n.right;
+      if (box_dist2(nodes[second], p) < box_dist2(nodes[first], p)) {
+        first = n.right;
+        second = n.left;
+      }
+      stack.push_back(second);
+      stack.push_back(first);
+    }
+    return best;
+  }
+};
+
+// One-sided Hausdorff estimate: max distance from every original vertex to
+// the simplified surface (O(log n) BVH query per vertex).
+static double max_deviation(const std::vector<float> &src_pos,
+                            const std::vector<float> &pos,
+                            const std::vector<uint32_t> &tris) {
+  size_t n_tris = tris.size() / 3;
+  size_t n_src = src_pos.size() / 3;
+  if (n_tris == 0 || n_src == 0)
+    return 0.0;
+
+  Bvh bvh;
+  bvh.pos = &pos;
+  bvh.tris = &tris;
+  bvh.order.resize(n_tris);
+  bvh.centroid.resize(n_tris * 3);
+  for (size_t t = 0; t < n_tris; ++t) {
+    bvh.order[t] = (uint32_t)t;
+    for (int k = 0; k < 3; ++k)
+      bvh.centroid[t * 3 + k] = (pos[tris[t * 3 + 0] * 3 + k] +
+                                 pos[tris[t * 3 + 1] * 3 + k] +
+                                 pos[tris[t * 3 + 2] * 3 + k]) /
+                                3.0;
+  }
+  bvh.nodes.reserve(2 * n_tris / 4 + 1);
+  bvh.build(0, (uint32_t)n_tris);
+
+  double worst = 0.0;
+  for (size_t i = 0; i < n_src; ++i) {
+    double p[3] = {src_pos[i * 3 + 0], src_pos[i * 3 + 1], src_pos[i * 3 + 2]};
+    worst = fmax(worst, bvh.closest_dist2(p));
+  }
+  return sqrt(worst);
+}
+
+// Simplify (tolerance-based edge collapse, preserves manifoldness)
+// Returns the simplified manifold and a stats table:
+// { tris_before, tris_after [, max_deviation] }
+// max_deviation is only measured when the third argument is true.
+static int l_simplify(lua_State *L) {
+  ManifoldManifold *m = check_manifold(L, 1);
+  double tolerance = luaL_checknumber(L, 2);
+  int measure = lua_toboolean(L, 3);
+  if (tolerance < 0)
+    luaL_error(L, "Simplify tolerance must be non-negative");
+
+  ManifoldManifold *res = manifold_simplify(alloc_manifold(), m, tolerance);
+
+  double deviation = 0.0;
+  if (measure) {
+    std::vector<float> src_pos, pos;
+    std::vector<uint32_t> src_tris, tris;
+    read_mesh(m, src_pos, src_tris);
+    read_mesh(res, pos, tris);
+    deviation = max_deviation(src_pos, pos, tris);
+  }
+
+  push_manifold(L, res);
+
+  lua_newtable(L);
+  lua_pushnumber(L, (double)manifold_num_tri(m));
+  lua_setfield(L, -2, "tris_before");
+  lua_pushnumber(L, (double)manifold_num_tri(res));
+  lua_setfield(L, -2, "tris_after");
+  if (measure) {
+    lua_pushnumber(L, deviation);
+    lua_setfield(L, -2, "max_deviation");
+  }
+  return 2;
+}
+
 // Properties: Volume
 static int l_volume(lua_State *L) {
   ManifoldManifold *m = check_manifold(L, 1);
@@ -661,6 +915,7 @@ static const struct luaL_Reg csg_lib[] = {{"cube", l_cube},
                                           {"trim_by_plane", l_trim_by_plane},
                                           {"split_by_plane", l_split_by_plane},
                                           {"decompose", l_decompose},
+                                          {"simplify", l_simplify},
                                           {"volume", l_volume},
                                           {"surface_area", l_surface_area},
                                           {"to_mesh", l_to_mesh},
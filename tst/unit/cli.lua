@@ -19,6 +19,24 @@ function test_config_loading()
     if cli.config.viewer == nil then error("Default viewer missing") end
 end
 
+function test_parse_tolerance()
+    print("Testing --simplify Parsing...")
+    if cli.parse_tolerance("0.01") != 0.01 then error("Tolerance not parsed") end
+    if cli.parse_tolerance(nil) != nil then error("Missing tolerance accepted") end
+    if cli.parse_tolerance("abc") != nil then error("Non-numeric tolerance accepted") end
+end
+
+function test_real_home()
+    print("Testing Home Resolution...")
+    h = cli.get_real_home()
+    if h == nil or h == "" then error("Home directory not resolved") end
+    if cli.real_home != h then error("Home directory not cached") end
+    
+    if cli.passwd_home("root") == nil then error("passwd lookup failed for root") end
+    if cli.passwd_home("no_such_luametry_user") != nil then error("passwd lookup matched unknown user") end
+    if cli.getent_home("x; touch /tmp/luametry_pwned") != nil then error("getent accepted unsafe user name") end
+end
+
 function test_watch_discovery()
     print("Testing Watch Discovery...")
     files = cli.get_watch_files("tst/examples/hex_bolt.lua")
@@ -46,6 +64,8 @@ end
 -- Run them
 test_help_strings()
 test_config_loading()
+test_parse_tolerance()
+test_real_home()
 test_watch_discovery()
 test_screenshot()
 
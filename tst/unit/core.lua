@@ -174,6 +174,28 @@ function test_all_variants()
     v = cad.modify.round(v, 0.1)
 end
 
+function test_simplify()
+    print("Testing Simplify...")
+    s = cad.sphere({r=10, fn=128})
+    simple = cad.modify.simplify(s, 0.05)
+    simple2 = cad.simplify(s, 0.05) -- Hit the alias
+    
+    cad.render(simple)
+    if simple.stats.tris_after >= simple.stats.tris_before then error("Simplify did not reduce triangles") end
+    if simple.stats.max_deviation > 0.05 + 1e-4 then error("Simplify node deviation too large: " .. simple.stats.max_deviation) end
+    
+    vol = cad.query.volume(simple)
+    ref = cad.query.volume(s)
+    if math.abs(vol - ref) > 0.02 * ref then error("Simplify volume drift: " .. vol) end
+    
+    ok, stats = cad.export(s, "out/temp_simplify.stl", {simplify = 0.05})
+    if ok != true or stats == nil then error("Export did not return simplify stats") end
+    if stats.max_deviation > 0.05 + 1e-4 then error("Simplify deviation too large: " .. stats.max_deviation) end
+    os.remove("out/temp_simplify.stl")
+    
+    if pcall(cad.simplify, s) then error("Simplify without tolerance should fail") end
+end
+
 function test_text()
     print("Testing Text Extrusion...")
     t = cad.text("CAD", {h=10, t=1, z=2})
@@ -193,6 +215,7 @@ test_render()
 test_advanced_ops()
 test_queries()
 test_all_variants()
+test_simplify()
 test_text()
 
 print("\nUnit core tests completed successfully.")